@@ -0,0 +1,81 @@
+##############################
+## コンパイル時間のスケーリングを計測するスクリプト
+##
+## cmake -DLITERAL_SIZE=<文字数> -DCOMPILER=<コンパイラ>
+##       -DINCLUDE_DIRECTORY=<dir> -DOUTPUT_DIRECTORY=<dir>
+##       [-DDEFAULT_LIMITS=ON] -P CompileTimeScaling.cmake
+##
+## LITERAL_SIZE文字のリテラルを含むソースを生成して構文解析・定数評価だけを行い、
+## かかった時間を出力する。
+## 定数評価のステップ数の上限をLITERAL_SIZEに比例させているので、
+## 構築や連結が線形でなくなった場合はコンパイルエラーとなる。
+## DEFAULT_LIMITSをONにすると上限を変えずにコンパイラの既定値のままで評価する。
+##############################
+cmake_minimum_required( VERSION 3.22.1 )
+
+# 1行あたり64文字のリテラルを連結して、size文字のリテラルを作る
+function( make_literal_body size output )
+  set( chars_per_line 64 )
+  string( REPEAT "abcdefgh" 8 line )
+  math( EXPR line_num "${size} / ${chars_per_line}" )
+  math( EXPR rest_num "${size} % ${chars_per_line}" )
+
+  string( REPEAT "  \"${line}\"\n" ${line_num} body )
+  string( SUBSTRING ${line} 0 ${rest_num} rest )
+  string( APPEND body "  \"${rest}\"" )
+
+  set( ${output} "${body}" PARENT_SCOPE )
+endfunction()
+
+# 連結の結果もLITERAL_SIZE文字になるように、前半と後半を別に作る
+math( EXPR FRONT_SIZE "${LITERAL_SIZE} / 2" )
+math( EXPR BACK_SIZE "${LITERAL_SIZE} - ${FRONT_SIZE}" )
+
+make_literal_body( ${LITERAL_SIZE} LITERAL_BODY )
+make_literal_body( ${FRONT_SIZE} FRONT_BODY )
+make_literal_body( ${BACK_SIZE} BACK_BODY )
+
+set( source ${OUTPUT_DIRECTORY}/CompileTimeScaling_${LITERAL_SIZE}.cpp )
+configure_file( ${CMAKE_CURRENT_LIST_DIR}/CompileTimeScaling.cpp.in ${source} @ONLY )
+
+# 1文字あたりのステップ数の目安。2次になればすぐに上限を超える。
+math( EXPR step_limit "${LITERAL_SIZE} * 256 + 1048576" )
+
+# トップレベルのCMakeLists.txtはproject()の後でコンパイラを差し替えているので、
+# CMAKE_CXX_COMPILER_IDではなくコンパイラ自身に問い合わせる
+execute_process( COMMAND ${COMPILER} --version OUTPUT_VARIABLE compiler_version )
+
+if( DEFAULT_LIMITS )
+  set( limit_options "" )
+elseif( compiler_version MATCHES "clang" )
+  set( limit_options -fconstexpr-steps=${step_limit} )
+elseif( compiler_version MATCHES "GCC|g\\+\\+|Free Software Foundation" )
+  set( limit_options -fconstexpr-ops-limit=${step_limit} -fconstexpr-loop-limit=${step_limit} )
+endif()
+
+# %fはCMake 3.23以降でしか使えないので、それ以前では秒単位で計測する
+if( CMAKE_VERSION VERSION_GREATER_EQUAL 3.23 )
+  set( timestamp_format "%s%f" )
+  set( usec_per_unit 1 )
+else()
+  set( timestamp_format "%s" )
+  set( usec_per_unit 1000000 )
+endif()
+
+string( TIMESTAMP begin "${timestamp_format}" UTC )
+
+execute_process(
+  COMMAND ${COMPILER} -std=c++20 -fsyntax-only ${limit_options} -I${INCLUDE_DIRECTORY} ${source}
+  RESULT_VARIABLE result
+  ERROR_VARIABLE error_message
+  )
+
+string( TIMESTAMP end "${timestamp_format}" UTC )
+
+if( NOT result EQUAL 0 )
+  message( FATAL_ERROR "compile_time_scaling: size=${LITERAL_SIZE} default_limits=${DEFAULT_LIMITS} failed\n${error_message}" )
+endif()
+
+math( EXPR elapsed_ms "( ${end} - ${begin} ) * ${usec_per_unit} / 1000" )
+math( EXPR ns_per_char "( ${end} - ${begin} ) * ${usec_per_unit} * 1000 / ${LITERAL_SIZE}" )
+message( STATUS "compile_time_scaling: size=${LITERAL_SIZE} elapsed=${elapsed_ms}ms (${ns_per_char}ns/char)" )
@@ -0,0 +1,64 @@
+##############################
+## データファイルをコンパイル時定数として埋め込むための関数
+##
+## violet_embed( <target> FILES <file>...
+##               [HEADER <header name>] [NAMESPACE <namespace>]
+##               [BINARY] [DEDUPLICATE] )
+##
+## FILESに指定したファイルの内容を、<header name>(既定値は<target>_embed.hpp)に
+## inline constexprな変数として定義し、<target>からインクルードできるようにする。
+## 変数名はファイル名から作られる(例: schema/user.json -> user_json)。
+##
+## BINARY      : violet::STRING::Literalではなく、std::array<unsigned char, N>として定義する
+## DEDUPLICATE : 同じ内容のファイルは最初のものだけを実体として定義し、残りはその参照にする
+##
+## ヘッダはビルド時に生成されるので、ファイルを編集すると再生成される。
+## 生成したヘッダはviolet/string.hppをインクルードするので、violetのインクルードパスも<target>に追加する。
+##############################
+set( VIOLET_EMBED_DIRECTORY ${CMAKE_CURRENT_LIST_DIR} )
+get_filename_component( VIOLET_EMBED_INCLUDE_DIRECTORY ${VIOLET_EMBED_DIRECTORY} DIRECTORY )
+
+function( violet_embed TARGET_NAME )
+  cmake_parse_arguments( EMBED "BINARY;DEDUPLICATE" "HEADER;NAMESPACE" "FILES" ${ARGN} )
+
+  if( NOT EMBED_FILES )
+    message( FATAL_ERROR "violet_embed: FILES is not specified" )
+  endif()
+
+  if( NOT EMBED_HEADER )
+    set( EMBED_HEADER ${TARGET_NAME}_embed.hpp )
+  endif()
+
+  if( NOT EMBED_NAMESPACE )
+    string( MAKE_C_IDENTIFIER ${TARGET_NAME} EMBED_NAMESPACE )
+  endif()
+
+  set( embed_include_directory ${CMAKE_CURRENT_BINARY_DIR}/violet_embed/${TARGET_NAME} )
+  set( embed_output ${embed_include_directory}/${EMBED_HEADER} )
+
+  # 相対パスはCMakeLists.txtのあるディレクトリからのパスとみなす
+  set( embed_files "" )
+  foreach( file IN LISTS EMBED_FILES )
+    get_filename_component( file ${file} ABSOLUTE BASE_DIR ${CMAKE_CURRENT_SOURCE_DIR} )
+    list( APPEND embed_files ${file} )
+  endforeach()
+
+  string( REPLACE ";" "|" embed_files_argument "${embed_files}" )
+
+  add_custom_command(
+    OUTPUT ${embed_output}
+    COMMAND ${CMAKE_COMMAND}
+      -DEMBED_OUTPUT=${embed_output}
+      -DEMBED_NAMESPACE=${EMBED_NAMESPACE}
+      -DEMBED_FILES=${embed_files_argument}
+      -DEMBED_BINARY=${EMBED_BINARY}
+      -DEMBED_DEDUPLICATE=${EMBED_DEDUPLICATE}
+      -P ${VIOLET_EMBED_DIRECTORY}/embed_generate.cmake
+    DEPENDS ${embed_files} ${VIOLET_EMBED_DIRECTORY}/embed_generate.cmake ${VIOLET_EMBED_DIRECTORY}/embed.hpp.in
+    COMMENT "Embedding resources into ${EMBED_HEADER}"
+    VERBATIM
+    )
+
+  target_sources( ${TARGET_NAME} PRIVATE ${embed_output} )
+  target_include_directories( ${TARGET_NAME} PUBLIC ${embed_include_directory} ${VIOLET_EMBED_INCLUDE_DIRECTORY} )
+endfunction( violet_embed )
@@ -0,0 +1,74 @@
+##############################
+## violet_embedから呼び出される、ヘッダを生成するスクリプト
+##
+## cmake -DEMBED_OUTPUT=<header> -DEMBED_NAMESPACE=<namespace>
+##       -DEMBED_FILES=<file>|<file>|... -DEMBED_BINARY=<ON|OFF>
+##       -DEMBED_DEDUPLICATE=<ON|OFF> -P embed_generate.cmake
+##
+## リストをコマンドライン引数で渡すと';'で分割されてしまうので、
+## EMBED_FILESは'|'区切りで受け取る。
+##############################
+cmake_minimum_required( VERSION 3.22.1 )
+
+string( REPLACE "|" ";" files "${EMBED_FILES}" )
+
+set( EMBED_DEFINITIONS "" )
+set( embedded_hashes "" )
+set( embedded_names "" )
+
+foreach( file IN LISTS files )
+  # ファイル名から識別子を作る(例: schema/user.json -> user_json)
+  get_filename_component( name ${file} NAME )
+  string( MAKE_C_IDENTIFIER ${name} name )
+
+  if( name IN_LIST embedded_names )
+    message( FATAL_ERROR "violet_embed: ${file} has the same identifier as another file (${name})" )
+  endif()
+
+  file( SHA256 ${file} hash )
+  list( FIND embedded_hashes ${hash} duplicate_index )
+
+  # 同じ内容のファイルは最初のものだけを実体として定義し、残りは参照にする
+  if( EMBED_DEDUPLICATE AND NOT duplicate_index EQUAL -1 )
+    list( GET embedded_names ${duplicate_index} original_name )
+    string( APPEND EMBED_DEFINITIONS "// ${name} has the same contents as ${original_name}\n" )
+    string( APPEND EMBED_DEFINITIONS "inline constexpr auto const & ${name} = ${original_name};\n\n" )
+  else()
+    file( READ ${file} hex HEX )
+    string( LENGTH "${hex}" hex_length )
+
+    if( EMBED_BINARY )
+      # 1行あたり16バイト
+      string( REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1, " bytes "${hex}" )
+      string( REPEAT "0x.., " 16 line_pattern )
+      string( REGEX REPLACE "(${line_pattern})" "\\1\n  " bytes "${bytes}" )
+      math( EXPR size "${hex_length} / 2" )
+      string( APPEND EMBED_DEFINITIONS "inline constexpr std::array<unsigned char, ${size}> ${name} = {\n  ${bytes}\n};\n\n" )
+    else()
+      # Literalは空文字列を扱えない
+      if( hex_length EQUAL 0 )
+        message( FATAL_ERROR "violet_embed: ${file} is empty. Use BINARY to embed empty files" )
+      endif()
+
+      # すべての文字を16進エスケープするので、ファイルの内容によらず文字列リテラルとして正しい。
+      string( REGEX REPLACE "([0-9a-f][0-9a-f])" "\\\\x\\1" chars "${hex}" )
+
+      # Literalは最初の'\0'までを文字列とみなすので、それ以降が黙って切り捨てられてしまう。
+      # '\'はエスケープの先頭にしか現れないので、"\x00"が見つかればNULバイトがある。
+      string( FIND "${chars}" "\\x00" nul_position )
+      if( NOT nul_position EQUAL -1 )
+        message( FATAL_ERROR "violet_embed: ${file} contains a NUL byte. Use BINARY to embed files containing NUL bytes" )
+      endif()
+
+      # 1行あたり16バイト
+      string( REPEAT "\\\\x.." 16 line_pattern )
+      string( REGEX REPLACE "(${line_pattern})" "\\1\"\n  \"" chars "${chars}" )
+      string( APPEND EMBED_DEFINITIONS "inline constexpr violet::STRING::Literal ${name}(\n  \"${chars}\"\n);\n\n" )
+    endif()
+  endif()
+
+  list( APPEND embedded_hashes ${hash} )
+  list( APPEND embedded_names ${name} )
+endforeach()
+
+configure_file( ${CMAKE_CURRENT_LIST_DIR}/embed.hpp.in ${EMBED_OUTPUT} @ONLY )
@@ -0,0 +1,29 @@
+/*****************************
+ * Copyright (c) 2023 Akito-Dataminer
+ * This software is distributed under the MIT license.
+ *****************************/
+
+#include "violet/csv.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/interface.hpp>
+#include <boost/test/tools/old/interface.hpp>
+
+BOOST_AUTO_TEST_SUITE( test_violet_csv )
+
+using namespace violet;
+using namespace violet::STRING;
+
+BOOST_AUTO_TEST_CASE( test_Field ) {
+  STATIC_CONSTEXPR Literal plain( "name" );
+  STATIC_CONSTEXPR Literal quoted( "\"last, first\"" );
+  STATIC_CONSTEXPR Literal doubled( "\"say \"\"hi\"\"\"" );
+
+  static_assert( CSV::Field<Literal( "name" )> == plain );
+  static_assert( CSV::Field<Literal( "last, first" )> == quoted );
+  static_assert( CSV::Field<Literal( "say \"hi\"" )> == doubled );
+
+  BOOST_CHECK( CSV::Field<Literal( "last, first" )> == quoted );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,56 @@
+/*****************************
+ * Copyright (c) 2023 Akito-Dataminer
+ * This software is distributed under the MIT license.
+ *****************************/
+
+// test/CMakeLists.txtのviolet_embedで生成されたヘッダ
+#include "embedTest_embed.hpp"
+#include "embedTest_binary.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/interface.hpp>
+#include <boost/test/tools/old/interface.hpp>
+
+BOOST_AUTO_TEST_SUITE( test_violet_embed )
+
+BOOST_AUTO_TEST_CASE( test_embed_literal ) {
+  using namespace violet::STRING;
+
+  STATIC_CONSTEXPR Literal select_user( "SELECT id, name FROM users WHERE id = ?;\n" );
+  STATIC_CONSTEXPR Literal schema( "{\"type\":\"object\",\"required\":[\"id\"]}" );
+
+  static_assert( embedTest::select_user_sql.length() == 41 );
+  static_assert( embedTest::select_user_sql == select_user );
+  static_assert( embedTest::schema_json == schema );
+
+  BOOST_CHECK( embedTest::select_user_sql == select_user );
+  BOOST_CHECK( IsSame<embedTest::schema_json>( "{\"type\":\"object\",\"required\":[\"id\"]}" ) );
+}
+
+BOOST_AUTO_TEST_CASE( test_embed_deduplicate ) {
+  // 同じ内容のファイルは同じオブジェクトを参照する
+  static_assert( &embedTest::select_user_copy_sql == &embedTest::select_user_sql );
+
+  BOOST_CHECK( &embedTest::select_user_copy_sql == &embedTest::select_user_sql );
+}
+
+BOOST_AUTO_TEST_CASE( test_embed_binary ) {
+  static_assert( embedTest::binary::table_bin.size() == 4 );
+  static_assert( embedTest::binary::table_bin[0] == 0x00 );
+  static_assert( embedTest::binary::table_bin[2] == 0xff );
+
+  BOOST_CHECK( embedTest::binary::table_bin[1] == 0x01 );
+  BOOST_CHECK( embedTest::binary::table_bin[3] == 0x7f );
+}
+
+BOOST_AUTO_TEST_CASE( test_embed_binary_with_nul ) {
+  // NULバイトを含むファイルも、BINARYなら途中で切れずに埋め込める
+  static_assert( embedTest::binary::with_nul_txt.size() == 8 );
+  static_assert( embedTest::binary::with_nul_txt[2] == 0x00 );
+  static_assert( embedTest::binary::with_nul_txt[3] == 'n' );
+
+  BOOST_CHECK( embedTest::binary::with_nul_txt[2] == 0x00 );
+  BOOST_CHECK( embedTest::binary::with_nul_txt[7] == '\n' );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
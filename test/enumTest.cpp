@@ -0,0 +1,104 @@
+/*****************************
+ * Copyright (c) 2023 Akito-Dataminer
+ * This software is distributed under the MIT license.
+ *****************************/
+
+#include "violet/enum.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/interface.hpp>
+#include <boost/test/tools/old/interface.hpp>
+
+#include <cstdint>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE( test_violet_enum )
+
+using namespace violet::STRING;
+using namespace violet::ENUM;
+
+enum class Method : unsigned char { Get, Post, Put, Delete };
+using MethodNames = EnumNames<Method, Name<Method::Get, Literal( "GET" )>, Name<Method::Post, Literal( "POST" )>, Name<Method::Put, Literal( "PUT" )>, Name<Method::Delete, Literal( "DELETE" )>>;
+
+enum Level : int { Debug, Info, Warning, Error };
+using LevelNames = EnumNames<Level, Name<Debug, Literal( "debug" )>, Name<Info, Literal( "info" )>, Name<Warning, Literal( "warning" )>, Name<Error, Literal( "error" )>>;
+
+// 通信で使う値を持つ列挙型。値は0から始まらず、宣言の順番とも一致しない。
+enum class Opcode : std::uint8_t { Ping = 9, Pong = 10, Close = 8 };
+using OpcodeNames = EnumNames<Opcode, Name<Opcode::Ping, Literal( "PING" )>, Name<Opcode::Pong, Literal( "PONG" )>, Name<Opcode::Close, Literal( "CLOSE" )>>;
+
+enum class Status : int { Error = -1, Ok = 0, Retry = 1 };
+using StatusNames = EnumNames<Status, Name<Status::Retry, Literal( "retry" )>, Name<Status::Error, Literal( "error" )>, Name<Status::Ok, Literal( "ok" )>>;
+
+BOOST_AUTO_TEST_CASE( test_name ) {
+  static_assert( MethodNames::size == 4 );
+  static_assert( MethodNames::name( Method::Get ) == "GET" );
+  static_assert( MethodNames::name( Method::Delete ) == "DELETE" );
+  static_assert( MethodNames::name( static_cast<Method>( 4 ) ).empty() );
+
+  static_assert( LevelNames::name( Warning ) == "warning" );
+  static_assert( LevelNames::name( static_cast<Level>( -1 ) ).empty() );
+
+  BOOST_CHECK( MethodNames::name( Method::Post ) == "POST" );
+}
+
+BOOST_AUTO_TEST_CASE( test_explicit_value ) {
+  static_assert( OpcodeNames::name( Opcode::Ping ) == "PING" );
+  static_assert( OpcodeNames::name( Opcode::Pong ) == "PONG" );
+  static_assert( OpcodeNames::name( Opcode::Close ) == "CLOSE" );
+  static_assert( OpcodeNames::name( static_cast<Opcode>( 0 ) ).empty() );
+  static_assert( OpcodeNames::name( static_cast<Opcode>( 7 ) ).empty() );
+  static_assert( OpcodeNames::name( static_cast<Opcode>( 11 ) ).empty() );
+  static_assert( OpcodeNames::value<Literal( "PING" )>() == Opcode::Ping );
+
+  static_assert( StatusNames::name( Status::Error ) == "error" );
+  static_assert( StatusNames::name( Status::Retry ) == "retry" );
+  static_assert( StatusNames::name( static_cast<Status>( -2 ) ).empty() );
+  static_assert( StatusNames::name( static_cast<Status>( 2 ) ).empty() );
+
+  BOOST_CHECK( OpcodeNames::value( "PONG" ) == Opcode::Pong );
+  BOOST_CHECK( OpcodeNames::value( "CLOSE" ) == Opcode::Close );
+  BOOST_CHECK( StatusNames::value( "ok" ) == Status::Ok );
+  BOOST_CHECK( StatusNames::value( "error" ) == Status::Error );
+}
+
+BOOST_AUTO_TEST_CASE( test_value ) {
+  static_assert( MethodNames::value( "PUT" ) == Method::Put );
+  static_assert( MethodNames::value( "PATCH" ).has_value() == false );
+  static_assert( MethodNames::value<Literal( "DELETE" )>() == Method::Delete );
+  static_assert( LevelNames::value<Literal( "error" )>() == Error );
+
+  // This is error because "PATCH" is not a name of Method.
+  // static_assert( MethodNames::value<Literal( "PATCH" )>() == Method::Get );
+
+  std::string const wire = "POST";
+  BOOST_CHECK( MethodNames::value( wire ) == Method::Post );
+  BOOST_CHECK( MethodNames::value( "post" ).has_value() == false );
+  BOOST_CHECK( MethodNames::value( "" ).has_value() == false );
+}
+
+BOOST_AUTO_TEST_CASE( test_round_trip ) {
+  for ( auto const name : StatusNames::names ) {
+    auto const status = StatusNames::value( name );
+    BOOST_REQUIRE( status.has_value() );
+    BOOST_CHECK( StatusNames::name( *status ) == name );
+  }
+}
+
+// This is error because names are duplicated.
+// using DuplicatedNames = EnumNames<Method, Name<Method::Get, Literal( "GET" )>, Name<Method::Post, Literal( "GET" )>>;
+// static_assert( DuplicatedNames::size == 2 );
+
+// This is error because Method::Get has two names.
+// using DuplicatedValues = EnumNames<Method, Name<Method::Get, Literal( "GET" )>, Name<Method::Get, Literal( "POST" )>>;
+// static_assert( DuplicatedValues::size == 2 );
+
+// This is error because Method::Post (between Method::Get and Method::Put) has no name.
+// using MissingNames = EnumNames<Method, Name<Method::Get, Literal( "GET" )>, Name<Method::Put, Literal( "PUT" )>>;
+// static_assert( MissingNames::size == 2 );
+
+// This is error because Level::Info is not an enumerator of Method.
+// using OtherEnum = EnumNames<Method, Name<Method::Get, Literal( "GET" )>, Name<Info, Literal( "POST" )>>;
+// static_assert( OtherEnum::size == 2 );
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,121 @@
+/*****************************
+ * Copyright (c) 2023 Akito-Dataminer
+ * This software is distributed under the MIT license.
+ *****************************/
+
+#include "violet/interner.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/interface.hpp>
+#include <boost/test/tools/old/interface.hpp>
+
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE( test_violet_interner )
+
+using namespace violet;
+using namespace violet::STRING;
+
+using HttpInterner = Interner<Literal( "GET" ), Literal( "POST" ), Literal( "PUT" ), Literal( "DELETE" ), Literal( "content-type" ), Literal( "content-length" )>;
+
+BOOST_AUTO_TEST_CASE( test_seeded ) {
+  static_assert( HttpInterner::seeded_size == 6 );
+  static_assert( HttpInterner::id<Literal( "GET" )>() == 0 );
+  static_assert( HttpInterner::id<Literal( "content-length" )>() == 5 );
+
+  // This is error because "PATCH" is not seeded.
+  // static_assert( HttpInterner::id<Literal( "PATCH" )>() == 0 );
+
+  HttpInterner interner( 16 );
+
+  BOOST_CHECK( interner.intern( "POST" ) == HttpInterner::id<Literal( "POST" )>() );
+  BOOST_CHECK( interner.intern( std::string( "content-type" ) ) == HttpInterner::id<Literal( "content-type" )>() );
+  BOOST_CHECK( interner.name( HttpInterner::id<Literal( "DELETE" )>() ) == "DELETE" );
+  BOOST_CHECK( interner.size() == 6 );
+}
+
+BOOST_AUTO_TEST_CASE( test_runtime ) {
+  HttpInterner interner( 16 );
+
+  BOOST_CHECK( interner.find( "x-request-id" ).has_value() == false );
+
+  auto const id = interner.intern( "x-request-id" );
+  BOOST_CHECK( id >= HttpInterner::seeded_size );
+  BOOST_CHECK( interner.intern( std::string( "x-request-id" ) ) == id );
+  BOOST_CHECK( interner.find( "x-request-id" ) == id );
+  BOOST_CHECK( interner.name( id ) == "x-request-id" );
+  BOOST_CHECK( interner.size() == 7 );
+
+  BOOST_CHECK( interner.intern( "x-trace-id" ) != id );
+  BOOST_CHECK_THROW( interner.name( id + 1000 ), std::out_of_range );
+}
+
+BOOST_AUTO_TEST_CASE( test_capacity ) {
+  Interner<Literal( "GET" )> interner( 2 );
+
+  interner.intern( "a" );
+  interner.intern( "b" );
+  // 登録済みの文字列は容量を消費しない
+  interner.intern( "a" );
+  interner.intern( "GET" );
+
+  BOOST_CHECK_THROW( interner.intern( "c" ), std::length_error );
+}
+
+BOOST_AUTO_TEST_CASE( test_capacity_too_large ) {
+  using SmallInterner = Interner<Literal( "GET" )>;
+
+  // スロットを確保する前に例外を投げる
+  BOOST_CHECK_THROW( SmallInterner{ std::numeric_limits<size_type>::max() }, std::length_error );
+  BOOST_CHECK_THROW( SmallInterner{ std::numeric_limits<SmallInterner::id_type>::max() }, std::length_error );
+  // 2のべき乗に切り上げるとIDが足りなくなる
+  BOOST_CHECK_THROW( SmallInterner{ std::numeric_limits<SmallInterner::id_type>::max() / 2 }, std::length_error );
+}
+
+BOOST_AUTO_TEST_CASE( test_concurrent ) {
+  STATIC_CONSTEXPR size_type thread_num = 8;
+  STATIC_CONSTEXPR size_type key_num = 500;
+
+  HttpInterner interner( key_num );
+  std::vector<std::vector<HttpInterner::id_type>> ids( thread_num, std::vector<HttpInterner::id_type>( key_num ) );
+  std::vector<std::thread> threads;
+
+  // すべてのスレッドが同じ文字列を同時に登録する
+  for ( size_type t = 0; t < thread_num; ++t ) {
+    threads.emplace_back( [&interner, &ids, t]() {
+      for ( size_type k = 0; k < key_num; ++k ) { ids[t][k] = interner.intern( "field" + std::to_string( k ) ); }
+    } );
+  }
+  for ( auto & thread : threads ) { thread.join(); }
+
+  for ( size_type t = 1; t < thread_num; ++t ) { BOOST_CHECK( ids[t] == ids[0] ); }
+  for ( size_type k = 0; k < key_num; ++k ) { BOOST_CHECK( interner.name( ids[0][k] ) == "field" + std::to_string( k ) ); }
+  BOOST_CHECK( interner.size() == HttpInterner::seeded_size + key_num );
+}
+
+BOOST_AUTO_TEST_CASE( test_concurrent_at_capacity ) {
+  STATIC_CONSTEXPR size_type thread_num = 8;
+  STATIC_CONSTEXPR size_type round_num = 1000;
+
+  // 容量ちょうどの文字列を全スレッドが同時に登録する。
+  // 他のスレッドが先に登録して容量に達しても、登録済みの文字列なので例外を投げてはいけない。
+  for ( size_type round = 0; round < round_num; ++round ) {
+    Interner<Literal( "GET" )> interner( 1 );
+    std::vector<Interner<Literal( "GET" )>::id_type> ids( thread_num );
+    std::vector<std::thread> threads;
+
+    for ( size_type t = 0; t < thread_num; ++t ) {
+      threads.emplace_back( [&interner, &ids, t]() { ids[t] = interner.intern( "x" ); } );
+    }
+    for ( auto & thread : threads ) { thread.join(); }
+
+    for ( size_type t = 1; t < thread_num; ++t ) { BOOST_CHECK( ids[t] == ids[0] ); }
+    BOOST_CHECK( interner.size() == 2 );
+    BOOST_CHECK_THROW( interner.intern( "y" ), std::length_error );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
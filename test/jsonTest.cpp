@@ -0,0 +1,89 @@
+/*****************************
+ * Copyright (c) 2023 Akito-Dataminer
+ * This software is distributed under the MIT license.
+ *****************************/
+
+#include "violet/json.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/interface.hpp>
+#include <boost/test/tools/old/interface.hpp>
+
+#include <cmath>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE( test_violet_json )
+
+using namespace violet;
+using namespace violet::STRING;
+
+BOOST_AUTO_TEST_CASE( test_Key ) {
+  STATIC_CONSTEXPR Literal expected( "\"name\":" );
+  STATIC_CONSTEXPR Literal expected_escaped( "\"say \\\"hi\\\"\\n\\u0001\":" );
+
+  static_assert( JSON::Key<Literal( "name" )> == expected );
+  static_assert( JSON::Key<Literal( "name" )>.length() == 7 );
+  static_assert( JSON::Key<Literal( "say \"hi\"\n\x01" )> == expected_escaped );
+
+  BOOST_CHECK( JSON::Key<Literal( "name" )> == expected );
+}
+
+BOOST_AUTO_TEST_CASE( test_CleanPrefixLength ) {
+  std::string const clean( 100, 'a' );
+  BOOST_CHECK( JSON::CleanPrefixLength( clean.data(), clean.size() ) == 100 );
+
+  // 16文字と8文字の境界の前後に、エスケープが必要な文字を置く
+  for ( size_type position = 0; position < 40; ++position ) {
+    for ( char const special : { '"', '\\', '\n', '\x1f' } ) {
+      std::string str( 40, 'b' );
+      str[position] = special;
+      BOOST_CHECK( JSON::CleanPrefixLength( str.data(), str.size() ) == position );
+    }
+  }
+
+  // 0x80以上(UTF-8)と0x20はエスケープしない
+  std::string const utf8 = "\xe3\x81\x82\xe3\x81\x84 \x7f\xff\x80 abcdefghijklmnop";
+  BOOST_CHECK( JSON::CleanPrefixLength( utf8.data(), utf8.size() ) == utf8.size() );
+}
+
+BOOST_AUTO_TEST_CASE( test_Writer_object ) {
+  std::string buffer;
+  JSON::Writer writer( buffer );
+
+  writer.beginObject()
+    .field<Literal( "name" )>( "violet \"v1\"\n" )
+    .field<Literal( "count" )>( 42 )
+    .field<Literal( "ratio" )>( 0.5 )
+    .field<Literal( "enabled" )>( true )
+    .field<Literal( "nan" )>( std::nan( "" ) )
+    .field<Literal( "none" )>( nullptr );
+
+  writer.key<Literal( "tags" )>().beginArray().element( "a" ).element( 1 ).beginObject().endObject().endArray();
+  writer.endObject();
+
+  BOOST_CHECK_EQUAL( buffer, "{\"name\":\"violet \\\"v1\\\"\\n\",\"count\":42,\"ratio\":0.5,\"enabled\":true,\"nan\":null,\"none\":null,\"tags\":[\"a\",1,{}]}" );
+}
+
+BOOST_AUTO_TEST_CASE( test_Writer_char ) {
+  std::string buffer;
+  JSON::Writer writer( buffer );
+
+  // charは文字列として、signed char/unsigned charは数値として書く
+  writer.beginArray().element( 'a' ).element( '"' ).element( '\n' ).element( static_cast<unsigned char>( 97 ) ).element( static_cast<signed char>( -1 ) ).endArray();
+  writer.beginObject().field<Literal( "sep" )>( ',' ).endObject();
+
+  BOOST_CHECK_EQUAL( buffer, "[\"a\",\"\\\"\",\"\\n\",97,-1]{\"sep\":\",\"}" );
+}
+
+BOOST_AUTO_TEST_CASE( test_Writer_top_level ) {
+  std::string buffer;
+  JSON::Writer writer( buffer );
+
+  // トップレベルの値の間には','を挟まない
+  writer.beginObject().field<Literal( "id" )>( 1 ).endObject().raw( '\n' );
+  writer.beginObject().field<Literal( "id" )>( 2 ).endObject().raw( '\n' );
+
+  BOOST_CHECK_EQUAL( buffer, "{\"id\":1}\n{\"id\":2}\n" );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
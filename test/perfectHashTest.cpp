@@ -0,0 +1,33 @@
+/*****************************
+ * Copyright (c) 2023 Akito-Dataminer
+ * This software is distributed under the MIT license.
+ *****************************/
+
+#include "violet/perfect_hash.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/interface.hpp>
+#include <boost/test/tools/old/interface.hpp>
+
+BOOST_AUTO_TEST_SUITE( test_violet_perfect_hash )
+
+using namespace violet::STRING;
+
+BOOST_AUTO_TEST_CASE( test_PerfectHash ) {
+  STATIC_CONSTEXPR PerfectHash<4> perfect_hash( std::array<std::string_view, 4>{ "id", "name", "type", "value" } );
+
+  static_assert( perfect_hash.find( "id", Hash( "id" ) ) == 0 );
+  static_assert( perfect_hash.find( "value", Hash( "value" ) ) == 3 );
+  static_assert( perfect_hash.find( "values", Hash( "values" ) ) == perfect_hash.npos );
+
+  // This is error because keys are duplicated.
+  // STATIC_CONSTEXPR PerfectHash<2> duplicated( std::array<std::string_view, 2>{ "id", "id" } );
+}
+
+BOOST_AUTO_TEST_CASE( test_PerfectHash_empty ) {
+  STATIC_CONSTEXPR PerfectHash<0> perfect_hash( std::array<std::string_view, 0>{} );
+
+  static_assert( perfect_hash.find( "id", Hash( "id" ) ) == perfect_hash.npos );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -13,6 +13,7 @@
 #include <string>
 #include <cstring>
 #include <utility>
+#include <type_traits>
 
 #define OPTION_LIST { "directory", "help", "version" }
 
@@ -266,6 +267,52 @@ BOOST_AUTO_TEST_CASE( test_operator_eq ) {
   BOOST_CHECK( ( literal1 == literal3 ) == false );
 }
 
+BOOST_AUTO_TEST_CASE( test_oversized_buffer ) {
+  using namespace violet::STRING;
+
+  // 配列が文字列よりも長くても、長さは最初の'\0'までになる
+  STATIC_CONSTEXPR char const buffer[8] = "abc";
+  STATIC_CONSTEXPR Literal literal( buffer );
+  STATIC_CONSTEXPR Literal literal_test( "abc" );
+
+  static_assert( literal.size() == 7 );
+  static_assert( literal.length() == 3 );
+  static_assert( literal == literal_test );
+
+  BOOST_CHECK( literal.length() == 3 );
+  BOOST_CHECK( literal == literal_test );
+}
+
+BOOST_AUTO_TEST_CASE( test_ExcludeNULLLiteralImpl_deduction ) {
+  using namespace violet::STRING;
+
+  // 長さを渡すコンストラクタでも、末尾の'\0'を含めない型に推論される
+  STATIC_CONSTEXPR ExcludeNULLLiteralImpl impl( "abc", Length( "abc" ) );
+
+  static_assert( std::is_same_v<std::remove_cvref_t<decltype( impl )>, ExcludeNULLLiteralImpl<char, 3>> );
+  static_assert( impl.length() == 3 );
+
+  BOOST_CHECK( impl.length() == 3 );
+}
+
+BOOST_AUTO_TEST_CASE( test_Concate_oversized_buffer ) {
+  using namespace violet::STRING;
+
+  STATIC_CONSTEXPR char const buffer[8] = "abc";
+  STATIC_CONSTEXPR Literal literal1( buffer );
+  STATIC_CONSTEXPR Literal literal2( "x" );
+  STATIC_CONSTEXPR auto literal3 = literal1 + literal2;
+  STATIC_CONSTEXPR Literal literal_test( "abcx" );
+
+  static_assert( literal3.length() == 4 );
+  static_assert( literal3.size() == 8 );
+  static_assert( literal3 == literal_test );
+  static_assert( literal3[3] == 'x' );
+
+  BOOST_CHECK( literal3.length() == 4 );
+  BOOST_CHECK( literal3 == literal_test );
+}
+
 BOOST_AUTO_TEST_CASE( test_output_stream ) {
   using namespace violet;
   using namespace violet::STRING;
@@ -0,0 +1,70 @@
+/*****************************
+ * Copyright (c) 2023 Akito-Dataminer
+ * This software is distributed under the MIT license.
+ *****************************/
+
+#include "violet/util/arena.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/interface.hpp>
+#include <boost/test/tools/old/interface.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE( test_util_arena )
+
+using namespace violet::util;
+
+BOOST_AUTO_TEST_CASE( test_allocate_align ) {
+  Arena arena( 64 );
+
+  for ( int i = 0; i < 100; ++i ) {
+    void * ptr = arena.allocate( 3, 8 );
+    BOOST_CHECK( reinterpret_cast<std::uintptr_t>( ptr ) % 8 == 0 );
+  }
+}
+
+BOOST_AUTO_TEST_CASE( test_allocate_larger_than_block ) {
+  Arena arena( 16 );
+
+  // ブロックより大きな領域も確保できる
+  char * ptr = static_cast<char *>( arena.allocate( 100, 1 ) );
+  std::memset( ptr, 'a', 100 );
+  BOOST_CHECK( ptr[99] == 'a' );
+}
+
+BOOST_AUTO_TEST_CASE( test_allocate_concurrent ) {
+  STATIC_CONSTEXPR int thread_num = 8;
+  STATIC_CONSTEXPR int allocation_num = 1000;
+
+  Arena arena( 256 );
+  std::vector<std::vector<std::uint64_t *>> ptrs( thread_num );
+  std::vector<std::thread> threads;
+
+  for ( int t = 0; t < thread_num; ++t ) {
+    threads.emplace_back( [&arena, &ptrs, t]() {
+      for ( int i = 0; i < allocation_num; ++i ) {
+        auto * ptr = static_cast<std::uint64_t *>( arena.allocate( sizeof( std::uint64_t ), alignof( std::uint64_t ) ) );
+        *ptr = t * allocation_num + i;
+        ptrs[t].push_back( ptr );
+      }
+    } );
+  }
+  for ( auto & thread : threads ) { thread.join(); }
+
+  // 確保した領域が重なっていなければ、書き込んだ値がそのまま残っている
+  std::set<std::uint64_t *> unique_ptrs;
+  for ( int t = 0; t < thread_num; ++t ) {
+    for ( int i = 0; i < allocation_num; ++i ) {
+      BOOST_CHECK( *ptrs[t][i] == static_cast<std::uint64_t>( t * allocation_num + i ) );
+      unique_ptrs.insert( ptrs[t][i] );
+    }
+  }
+  BOOST_CHECK( unique_ptrs.size() == thread_num * allocation_num );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
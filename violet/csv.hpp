@@ -0,0 +1,63 @@
+/*****************************
+ * Copyright (c) 2023 Akito-Dataminer
+ * This software is distributed under the MIT license.
+ *****************************/
+
+#pragma once
+
+#include "violet/string.hpp"
+#include "violet/util/util.hpp"
+
+namespace violet {
+
+namespace CSV {
+
+// CSVのフィールド中で'"'で囲まなければならない文字ならtrueを返す(RFC 4180)
+constexpr bool NeedsQuote( char const one_char ) noexcept {
+  return one_char == ',' || one_char == '"' || one_char == '\n' || one_char == '\r';
+}
+
+template<STRING::Literal LITERAL>
+consteval bool NeedsQuote() {
+  for ( size_type index = 0; index < LITERAL.length(); ++index ) {
+    if ( NeedsQuote( LITERAL[index] ) ) { return true; }
+  }
+
+  return false;
+}
+
+template<STRING::Literal LITERAL>
+consteval size_type QuotedLength() {
+  if ( !NeedsQuote<LITERAL>() ) { return LITERAL.length(); }
+
+  // 前後の'"'と、'"'を重ねる分
+  size_type length = LITERAL.length() + 2;
+  for ( size_type index = 0; index < LITERAL.length(); ++index ) { length += ( LITERAL[index] == '"' ) ? 1 : 0; }
+
+  return length;
+}
+
+// 必要な場合だけ'"'で囲み、中の'"'を重ねたフィールド。ヘッダ行などの固定の文字列に使う。
+template<STRING::Literal LITERAL>
+consteval auto Quote() {
+  STRING::Literal<char, QuotedLength<LITERAL>()> result;
+  bool const needs_quote = NeedsQuote<LITERAL>();
+
+  if ( needs_quote ) { result.str_[result.len_++] = '"'; }
+
+  for ( size_type index = 0; index < LITERAL.length(); ++index ) {
+    if ( LITERAL[index] == '"' ) { result.str_[result.len_++] = '"'; }
+    result.str_[result.len_++] = LITERAL[index];
+  }
+
+  if ( needs_quote ) { result.str_[result.len_++] = '"'; }
+
+  return result;
+}
+
+template<STRING::Literal LITERAL>
+inline constexpr auto Field = Quote<LITERAL>();
+
+} // CSV
+
+} // violet
@@ -0,0 +1,138 @@
+/*****************************
+ * Copyright (c) 2023 Akito-Dataminer
+ * This software is distributed under the MIT license.
+ *****************************/
+
+#pragma once
+
+#include "violet/string.hpp"
+#include "violet/perfect_hash.hpp"
+#include "violet/util/util.hpp"
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+namespace violet {
+
+namespace ENUM {
+
+/****************************************
+ * 列挙子と名前の組
+ *
+ * VALUEは列挙子(例: Name<Method::Get, Literal( "GET" )>)。
+ ****************************************/
+template<auto VALUE, STRING::Literal NAME>
+struct Name {
+  static_assert( std::is_enum_v<decltype( VALUE )>, "Name: VALUE is NOT an enumerator" );
+
+  using enum_type = decltype( VALUE );
+
+  static constexpr enum_type value = VALUE;
+  static constexpr std::string_view name = std::string_view( NAME.get(), NAME.length() );
+};
+
+template<typename T>
+struct IsName : std::false_type {};
+
+template<auto VALUE, STRING::Literal NAME>
+struct IsName<Name<VALUE, NAME>> : std::true_type {};
+
+// 最小値からの距離を返す。
+// 最小値より小さい値は、符号なしの引き算で折り返して大きな値になるので、範囲外として扱える
+template<typename E>
+constexpr size_type Offset( E const value, E const min_value ) noexcept {
+  using unsigned_type = std::make_unsigned_t<std::underlying_type_t<E>>;
+  return static_cast<unsigned_type>( static_cast<unsigned_type>( value ) - static_cast<unsigned_type>( min_value ) );
+}
+
+template<typename E, size_type N>
+consteval bool IsUnique( std::array<E, N> values ) {
+  std::sort( values.begin(), values.end() );
+  return std::adjacent_find( values.begin(), values.end() ) == values.end();
+}
+
+// すべての値が、最小値からN個の連続した値に収まっているか
+template<typename E, size_type N>
+consteval bool IsDense( std::array<E, N> const & values ) {
+  E const min_value = *std::min_element( values.begin(), values.end() );
+  return std::all_of( values.begin(), values.end(), [min_value]( E const value ) { return Offset( value, min_value ) < N; } );
+}
+
+// 値の順に名前を並べる
+template<typename E, size_type N>
+consteval std::array<std::string_view, N> NamesByValue( std::array<std::string_view, N> const & names, std::array<E, N> const & values ) {
+  E const min_value = *std::min_element( values.begin(), values.end() );
+  std::array<std::string_view, N> names_by_value{};
+
+  for ( size_type i = 0; i < N; ++i ) { names_by_value[Offset( values[i], min_value )] = names[i]; }
+
+  return names_by_value;
+}
+
+/****************************************
+ * 列挙子と名前を対応付ける表
+ *
+ * 列挙子と名前の組をName<E::X, Literal( "..." )>で並べる(並べる順番は問わない)。
+ * 名前は列挙子の値で対応付けるので、通信で使う値を持つ列挙型にもそのまま使える。
+ * 値は0から始まらなくてもよいが、重複していたり、最小値から最大値までの間に
+ * 名前のない値があったりするとコンパイルエラーになる。
+ *
+ * 列挙子から名前へは(値 - 最小値)を添字とする配列で、名前から列挙子へは完全ハッシュ表で変換するので、
+ * どちらも要素数によらず定数時間で、実行時にメモリを確保しない。
+ *
+ * 名前が重複していたり、value<NAME>()にない名前を指定したりすると、
+ * コンパイルエラーになる。
+ ****************************************/
+template<typename E, typename... NAMES>
+struct EnumNames {
+  static_assert( std::is_enum_v<E>, "EnumNames: E is NOT an enumeration type" );
+  static_assert( sizeof...( NAMES ) > 0, "EnumNames: NAMES is empty" );
+  static_assert( ( IsName<NAMES>::value && ... ), "EnumNames: NAMES are NOT Name<VALUE, NAME>" );
+  static_assert( ( std::is_same_v<typename NAMES::enum_type, E> && ... ), "EnumNames: a VALUE of NAMES is NOT an enumerator of E" );
+
+  using enum_type = E;
+  using underlying_type = std::underlying_type_t<E>;
+
+  static constexpr size_type size = sizeof...( NAMES );
+  // NAMESに並べた順番
+  static constexpr std::array<std::string_view, size> names = { NAMES::name... };
+  static constexpr std::array<E, size> values = { NAMES::value... };
+
+  // 名前のない値には空文字列を返す
+  static constexpr std::string_view name( E const value ) noexcept {
+    size_type const offset = Offset( value, min_value_ );
+    return ( offset < size ) ? names_by_value_[offset] : std::string_view();
+  }
+
+  static constexpr std::optional<E> value( std::string_view const str ) noexcept {
+    size_type const index = perfect_hash_.find( str, STRING::Hash( str ) );
+    return ( index != perfect_hash_.npos ) ? std::optional<E>( values[index] ) : std::nullopt;
+  }
+
+  // 名前から列挙子をコンパイル時に求める
+  template<STRING::Literal NAME>
+  static consteval E value() {
+    std::optional<E> const result = value( std::string_view( NAME.get(), NAME.length() ) );
+    return result.has_value() ? *result : throw std::invalid_argument( "value: name is not in EnumNames" );
+  }
+
+private:
+  // 値が重複せず、最小値からsize個の連続した値に収まっていれば、すべての値にちょうど1つの名前がある
+  static_assert( IsUnique( values ), "EnumNames: VALUEs of NAMES are duplicated" );
+  static_assert( IsDense( values ), "EnumNames: VALUEs of NAMES are NOT contiguous" );
+
+  static constexpr E min_value_ = *std::min_element( values.begin(), values.end() );
+  static constexpr std::array<std::string_view, size> names_by_value_ = NamesByValue( names, values );
+  static constexpr STRING::PerfectHash<size> perfect_hash_{ names };
+
+  // perfect_hash_を定数評価させて、名前の重複をクラスの実体化時にコンパイルエラーにする
+  static_assert( perfect_hash_.find( "", STRING::Hash( "" ) ) == perfect_hash_.npos );
+};
+
+} // ENUM
+
+} // violet
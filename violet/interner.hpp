@@ -0,0 +1,192 @@
+/*****************************
+ * Copyright (c) 2023 Akito-Dataminer
+ * This software is distributed under the MIT license.
+ *****************************/
+
+#pragma once
+
+#include "violet/string.hpp"
+#include "violet/perfect_hash.hpp"
+#include "violet/util/util.hpp"
+#include "violet/util/arena.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+namespace violet {
+
+namespace STRING {
+
+/****************************************
+ * 実行時の文字列を整数IDに変換するインターナ
+ *
+ * SEEDSに指定した文字列はコンパイル時に完全ハッシュ表に登録され、
+ * 0からsizeof...( SEEDS ) - 1までのIDを持つ(id<LITERAL>()でコンパイル時に取得できる)。
+ * それ以外の文字列は、初めて見つかったときにロックフリーな
+ * オープンアドレス法のハッシュ表に登録される。
+ *
+ * 登録した文字列は削除しないので、IDは一度決まれば変わらない。
+ * 実行時に登録した文字列のIDは連番ではなく、ハッシュ表のスロット番号から決まる。
+ * 読み出しはロックを取らず、登録もCASだけで行う。
+ ****************************************/
+template<Literal... SEEDS>
+class Interner {
+public:
+  using id_type = std::uint32_t;
+
+  static constexpr id_type seeded_size = sizeof...( SEEDS );
+
+  // capacityは実行時に登録できる文字列の数
+  explicit Interner( size_type const capacity, size_type const arena_block_size = 4096 )
+  : capacity_( checkCapacity( capacity ) )
+    , mask_( slotNum( capacity_ ) - 1 )
+    , slots_( std::make_unique<std::atomic<Entry const *>[]>( mask_ + 1 ) )
+    , runtime_size_( 0 )
+    , arena_( arena_block_size ) {}
+
+  Interner( Interner const & ) = delete;
+  Interner & operator=( Interner const & ) = delete;
+
+  // SEEDSに含まれる文字列のIDをコンパイル時に返す
+  template<Literal LITERAL>
+  static consteval id_type id() {
+    size_type const index = perfect_hash_.find( std::string_view( LITERAL.get(), LITERAL.length() ), Hash( std::string_view( LITERAL.get(), LITERAL.length() ) ) );
+    return ( index != perfect_hash_.npos ) ? static_cast<id_type>( index ) : throw std::invalid_argument( "id: literal is not seeded" );
+  }
+
+  id_type intern( std::string_view const str ) {
+    std::uint64_t const hash = Hash( str );
+
+    if ( size_type const index = perfect_hash_.find( str, hash ); index != perfect_hash_.npos ) { return static_cast<id_type>( index ); }
+
+    Entry const * pending = nullptr;
+
+    for ( size_type probe = 0, slot = hash & mask_; probe <= mask_; ++probe, slot = ( slot + 1 ) & mask_ ) {
+      Entry const * entry = slots_[slot].load( std::memory_order_acquire );
+
+      if ( entry == nullptr ) {
+        if ( pending == nullptr ) {
+          // 空きスロットを読んでから容量を調べるまでの間に、他のスレッドが同じ文字列を登録して
+          // 容量に達したかもしれないので、もう一度探してから例外を投げる
+          if ( isFull() ) {
+            if ( auto const id = find( str ) ) { return *id; }
+
+            throw std::length_error( "intern: capacity is exceeded" );
+          }
+
+          pending = makeEntry( str, hash );
+        }
+
+        if ( slots_[slot].compare_exchange_strong( entry, pending, std::memory_order_acq_rel, std::memory_order_acquire ) ) {
+          // 登録に成功したものだけを数える。
+          // releaseにしておくと、isFull()で容量に達したことを観測したスレッドからは、このスロットへの登録も見える。
+          runtime_size_.fetch_add( 1, std::memory_order_release );
+          return toId( slot );
+        }
+
+        // 他のスレッドが先に登録したので、entryにはそのスレッドが登録したものが入っている
+      }
+
+      // 同じ文字列を他のスレッドが先に登録していた。pendingの領域はArenaから解放できないので捨てる。
+      if ( entry->isSame( str, hash ) ) { return toId( slot ); }
+    }
+
+    throw std::length_error( "intern: table is full" );
+  }
+
+  std::optional<id_type> find( std::string_view const str ) const noexcept {
+    std::uint64_t const hash = Hash( str );
+
+    if ( size_type const index = perfect_hash_.find( str, hash ); index != perfect_hash_.npos ) { return static_cast<id_type>( index ); }
+
+    for ( size_type probe = 0, slot = hash & mask_; probe <= mask_; ++probe, slot = ( slot + 1 ) & mask_ ) {
+      Entry const * entry = slots_[slot].load( std::memory_order_acquire );
+
+      if ( entry == nullptr ) { return std::nullopt; }
+      if ( entry->isSame( str, hash ) ) { return toId( slot ); }
+    }
+
+    return std::nullopt;
+  }
+
+  std::string_view name( id_type const id ) const {
+    if ( id < seeded_size ) { return perfect_hash_.key( id ); }
+
+    Entry const * entry = ( ( id - seeded_size ) <= mask_ ) ? slots_[id - seeded_size].load( std::memory_order_acquire ) : nullptr;
+
+    return ( entry != nullptr ) ? std::string_view( entry->chars_, entry->length_ ) : throw std::out_of_range( "name: id is not interned" );
+  }
+
+  // SEEDSと実行時に登録した文字列の合計
+  size_type size() const noexcept { return seeded_size + runtime_size_.load( std::memory_order_relaxed ); }
+
+private:
+  struct Entry {
+    std::uint64_t hash_;
+    size_type length_;
+    char const * chars_;
+
+    bool isSame( std::string_view const str, std::uint64_t const hash ) const noexcept {
+      return hash_ == hash && length_ == str.size() && std::memcmp( chars_, str.data(), length_ ) == 0;
+    }
+  };
+
+  // 登録済みの数だけで容量を判定するので、同じ文字列を同時に登録しようとしたスレッドが
+  // 互いの分まで容量を消費したとみなして例外を投げることはない。
+  // 異なる文字列を同時に登録すると、その数だけcapacityを超えることがあるが、
+  // スロットはcapacityの2倍以上あり、足りなくなってもinternが例外を投げるだけで済む。
+  bool isFull() const noexcept { return runtime_size_.load( std::memory_order_acquire ) >= capacity_; }
+
+  Entry const * makeEntry( std::string_view const str, std::uint64_t const hash ) {
+    // Entryの直後に文字列を置く
+    void * memory = arena_.allocate( sizeof( Entry ) + str.size(), alignof( Entry ) );
+    char * chars = static_cast<char *>( memory ) + sizeof( Entry );
+    std::memcpy( chars, str.data(), str.size() );
+
+    return ::new ( memory ) Entry{ hash, str.size(), chars };
+  }
+
+  // 負荷率を1/2以下に保つため、スロット数はcapacityの2倍以上の2のべき乗にする
+  static size_type slotNum( size_type const capacity ) noexcept { return std::bit_ceil( 2 * std::max<size_type>( capacity, 1 ) ); }
+
+  // スロット数を計算したり確保したりする前に、すべてのスロットにIDを振れるかを確かめる
+  static size_type checkCapacity( size_type const capacity ) {
+    constexpr size_type id_num = std::numeric_limits<id_type>::max() - seeded_size;
+
+    // 2のべき乗に切り上げると最大でさらに2倍になるので、2倍した時点でid_num以下の
+    // 最大の2のべき乗に収まっていることも確かめる(先に2倍してもオーバーフローしないことを確かめる)。
+    if ( capacity > id_num / 2 || 2 * std::max<size_type>( capacity, 1 ) > std::bit_floor( id_num ) ) {
+      throw std::length_error( "Interner: capacity is too large" );
+    }
+
+    return capacity;
+  }
+
+  id_type toId( size_type const slot ) const noexcept { return static_cast<id_type>( seeded_size + slot ); }
+
+  static constexpr PerfectHash<seeded_size> perfect_hash_{ std::array<std::string_view, seeded_size>{ std::string_view( SEEDS.get(), SEEDS.length() )... } };
+
+  // perfect_hash_は使われるまで定数評価されないので、ここで評価させてSEEDSの重複をコンパイルエラーにする。
+  // Literalは空文字列を持てないので、空文字列は必ず見つからない。
+  static_assert( perfect_hash_.find( "", Hash( "" ) ) == perfect_hash_.npos );
+
+  size_type capacity_;
+  size_type mask_;
+  std::unique_ptr<std::atomic<Entry const *>[]> slots_;
+  std::atomic<size_type> runtime_size_;
+  util::Arena arena_;
+};
+
+} // STRING
+
+} // violet
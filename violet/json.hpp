@@ -0,0 +1,258 @@
+/*****************************
+ * Copyright (c) 2023 Akito-Dataminer
+ * This software is distributed under the MIT license.
+ *****************************/
+
+#pragma once
+
+#include "violet/string.hpp"
+#include "violet/util/util.hpp"
+
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+namespace violet {
+
+namespace JSON {
+
+// 文字型は数値ではなく文字として書くので、数値の書き出しから除く
+template<typename T>
+inline constexpr bool is_character_v = std::is_same_v<T, char> || std::is_same_v<T, wchar_t> || std::is_same_v<T, char8_t> || std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>;
+
+// JSONの文字列中でエスケープしなければならない文字ならtrueを返す
+constexpr bool NeedsEscape( char const one_char ) noexcept {
+  return static_cast<unsigned char>( one_char ) < 0x20 || one_char == '"' || one_char == '\\';
+}
+
+// one_charをエスケープしてoutに書き込み、書き込んだ文字数を返す(最大6文字)。
+// コンパイル時のKeyと実行時のWriterで同じ規則を使う。
+constexpr size_type EscapeChar( char const one_char, char * const out ) noexcept {
+  switch ( one_char ) {
+    case '"':  out[0] = '\\'; out[1] = '"';  return 2;
+    case '\\': out[0] = '\\'; out[1] = '\\'; return 2;
+    case '\b': out[0] = '\\'; out[1] = 'b';  return 2;
+    case '\f': out[0] = '\\'; out[1] = 'f';  return 2;
+    case '\n': out[0] = '\\'; out[1] = 'n';  return 2;
+    case '\r': out[0] = '\\'; out[1] = 'r';  return 2;
+    case '\t': out[0] = '\\'; out[1] = 't';  return 2;
+    default: break;
+  }
+
+  if ( NeedsEscape( one_char ) ) {
+    constexpr char hex[] = "0123456789abcdef";
+    auto const code = static_cast<unsigned char>( one_char );
+
+    out[0] = '\\'; out[1] = 'u'; out[2] = '0'; out[3] = '0';
+    out[4] = hex[code >> 4]; out[5] = hex[code & 0x0f];
+    return 6;
+  }
+
+  out[0] = one_char;
+  return 1;
+}
+
+template<STRING::Literal LITERAL>
+consteval size_type EscapedLength() {
+  size_type length = 0;
+  char escaped[6] = {};
+
+  for ( size_type index = 0; index < LITERAL.length(); ++index ) { length += EscapeChar( LITERAL[index], escaped ); }
+
+  return length;
+}
+
+// LITERALをJSONの文字列としてエスケープする(前後の'"'は付けない)
+template<STRING::Literal LITERAL>
+consteval auto Escape() {
+  STRING::Literal<char, EscapedLength<LITERAL>()> result;
+
+  for ( size_type index = 0; index < LITERAL.length(); ++index ) { result.len_ += EscapeChar( LITERAL[index], result.str_ + result.len_ ); }
+
+  return result;
+}
+
+// "name": の形にエスケープしたキー。実行時にはmemcpyするだけでよい。
+// Literalの配列からのコンストラクタはexplicitなので、Key<"name">とは書けず、Key<Literal( "name" )>と書く。
+template<STRING::Literal NAME>
+inline constexpr auto Key = STRING::Concate( STRING::Concate( STRING::Literal( "\"" ), Escape<NAME>() ), STRING::Literal( "\":" ) );
+
+// エスケープが必要な文字が現れるまでの文字数を返す。
+// SSE2が使える場合は16文字ずつ、そうでなければ8文字ずつ(SWAR)調べるので、
+// エスケープの要らない部分はまとめてコピーできる。
+inline size_type CleanPrefixLength( char const * const str, size_type const length ) noexcept {
+  size_type index = 0;
+
+#if defined( __SSE2__ )
+  __m128i const quote = _mm_set1_epi8( '"' );
+  __m128i const backslash = _mm_set1_epi8( '\\' );
+  __m128i const control_max = _mm_set1_epi8( 0x1f );
+
+  for ( ; index + 16 <= length; index += 16 ) {
+    __m128i const chunk = _mm_loadu_si128( reinterpret_cast<__m128i const *>( str + index ) );
+    // 符号なしで0x1f以下 <=> max( chunk, 0x1f ) == 0x1f
+    __m128i const is_control = _mm_cmpeq_epi8( _mm_max_epu8( chunk, control_max ), control_max );
+    __m128i const needs_escape = _mm_or_si128( is_control, _mm_or_si128( _mm_cmpeq_epi8( chunk, quote ), _mm_cmpeq_epi8( chunk, backslash ) ) );
+    auto const mask = static_cast<unsigned int>( _mm_movemask_epi8( needs_escape ) );
+
+    if ( mask != 0 ) { return index + std::countr_zero( mask ); }
+  }
+#else
+  constexpr std::uint64_t ones = 0x0101010101010101ULL;
+  constexpr std::uint64_t highs = 0x8080808080808080ULL;
+
+  for ( ; index + 8 <= length; index += 8 ) {
+    std::uint64_t chunk;
+    std::memcpy( &chunk, str + index, 8 );
+
+    // 各バイトについて、0x20未満、'"'、'\\'なら最上位ビットが立つ
+    std::uint64_t const is_control = ( chunk - ones * 0x20 ) & ~chunk;
+    std::uint64_t const is_quote = ( ( chunk ^ ( ones * '"' ) ) - ones ) & ~( chunk ^ ( ones * '"' ) );
+    std::uint64_t const is_backslash = ( ( chunk ^ ( ones * '\\' ) ) - ones ) & ~( chunk ^ ( ones * '\\' ) );
+
+    if ( ( ( is_control | is_quote | is_backslash ) & highs ) != 0 ) { break; }
+  }
+#endif
+
+  while ( index < length && !NeedsEscape( str[index] ) ) { ++index; }
+
+  return index;
+}
+
+/****************************************
+ * JSONを文字列に書き出すクラス
+ *
+ * キーはKey<NAME>でコンパイル時にエスケープ済みなので、そのままコピーする。
+ * 実行時にエスケープするのは文字列の値だけ。
+ ****************************************/
+class Writer {
+public:
+  explicit Writer( std::string & buffer ) : buffer_( buffer ), depth_( 0 ), needs_separator_( false ) {}
+
+  Writer & beginObject() { return begin( '{' ); }
+  Writer & endObject() { return end( '}' ); }
+  Writer & beginArray() { return begin( '[' ); }
+  Writer & endArray() { return end( ']' ); }
+
+  // オブジェクトの先頭でなければ','を挟んでからキーを書く
+  template<STRING::Literal NAME>
+  Writer & key() {
+    separate();
+    raw( Key<NAME> );
+    // キーの直後の値の前には','を挟まない
+    needs_separator_ = false;
+    return *this;
+  }
+
+  template<STRING::Literal NAME, typename T>
+  Writer & field( T const & content ) { return key<NAME>().value( content ); }
+
+  // 配列の要素を書く
+  template<typename T>
+  Writer & element( T const & content ) { return value( content ); }
+
+  Writer & value( std::string_view const str ) {
+    separate();
+    raw( '"' );
+    escape( str );
+    raw( '"' );
+    needs_separator_ = true;
+    return *this;
+  }
+
+  Writer & value( char const * const str ) { return value( std::string_view( str ) ); }
+  Writer & value( std::string const & str ) { return value( std::string_view( str ) ); }
+  // 1文字の文字列として書く(signed char/unsigned charは数値として書く)
+  Writer & value( char const one_char ) { return value( std::string_view( &one_char, 1 ) ); }
+  Writer & value( bool const boolean ) { return boolean ? scalar( STRING::Literal( "true" ) ) : scalar( STRING::Literal( "false" ) ); }
+  Writer & value( std::nullptr_t ) { return scalar( STRING::Literal( "null" ) ); }
+
+  template<typename T, util::if_nullp_c<std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && !is_character_v<T>>* = nullptr>
+  Writer & value( T const number ) {
+    // JSONはNaNと無限大を表せない
+    if constexpr ( std::is_floating_point_v<T> ) {
+      if ( !std::isfinite( number ) ) { return value( nullptr ); }
+    }
+
+    separate();
+
+    char chars[64];
+    auto const result = std::to_chars( chars, chars + sizeof( chars ), number );
+    buffer_.append( chars, result.ptr );
+    needs_separator_ = true;
+    return *this;
+  }
+
+  // 区切りの','を管理せずにそのまま書き出す
+  template<typename CharT, size_type N>
+  Writer & raw( STRING::Literal<CharT, N> const & fragment ) {
+    buffer_.append( fragment.get(), fragment.length() );
+    return *this;
+  }
+
+  Writer & raw( char const one_char ) {
+    buffer_.push_back( one_char );
+    return *this;
+  }
+
+  // エスケープの要らない部分はまとめてコピーする
+  void escape( std::string_view str ) {
+    while ( !str.empty() ) {
+      size_type const clean_length = CleanPrefixLength( str.data(), str.size() );
+      buffer_.append( str.data(), clean_length );
+
+      if ( clean_length == str.size() ) { break; }
+
+      char escaped[6];
+      buffer_.append( escaped, EscapeChar( str[clean_length], escaped ) );
+      str.remove_prefix( clean_length + 1 );
+    }
+  }
+
+private:
+  // ','はオブジェクトか配列の中でだけ挟む。
+  // トップレベルの値の間には挟まないので、改行区切りのJSONも書ける。
+  void separate() {
+    if ( depth_ > 0 && needs_separator_ ) { buffer_.push_back( ',' ); }
+  }
+
+  Writer & begin( char const bracket ) {
+    separate();
+    raw( bracket );
+    ++depth_;
+    needs_separator_ = false;
+    return *this;
+  }
+
+  Writer & end( char const bracket ) {
+    raw( bracket );
+    --depth_;
+    needs_separator_ = true;
+    return *this;
+  }
+
+  template<size_type N>
+  Writer & scalar( STRING::Literal<char, N> const & literal ) {
+    separate();
+    raw( literal );
+    needs_separator_ = true;
+    return *this;
+  }
+
+  std::string & buffer_;
+  size_type depth_;
+  bool needs_separator_;
+};
+
+} // JSON
+
+} // violet
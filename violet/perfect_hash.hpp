@@ -0,0 +1,136 @@
+/*****************************
+ * Copyright (c) 2023 Akito-Dataminer
+ * This software is distributed under the MIT license.
+ *****************************/
+
+#pragma once
+
+#include "violet/util/util.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+namespace violet {
+
+namespace STRING {
+
+// FNV-1a。コンパイル時と実行時で同じハッシュ値を使う。
+constexpr std::uint64_t Hash( std::string_view const str ) noexcept {
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+
+  for ( char const one_char : str ) { hash = ( hash ^ static_cast<unsigned char>( one_char ) ) * 0x100000001b3ULL; }
+
+  return hash;
+}
+
+// ハッシュ値と変位から、別のハッシュ値を作る(splitmix64の最終段)。
+// 文字列を走査し直さずに、変位ごとに異なる位置へ散らすために使う。
+constexpr std::uint64_t Mix( std::uint64_t hash, std::uint64_t const displacement ) noexcept {
+  hash += displacement * 0x9e3779b97f4a7c15ULL;
+  hash = ( hash ^ ( hash >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+  hash = ( hash ^ ( hash >> 27 ) ) * 0x94d049bb133111ebULL;
+  return hash ^ ( hash >> 31 );
+}
+
+/****************************************
+ * コンパイル時に構築する完全ハッシュ表(hash and displace)
+ *
+ * キーをバケットに振り分け、キーの多いバケットから順に、
+ * バケット内のすべてのキーが空いているスロットに入る変位を探す。
+ * 検索はハッシュ値の計算1回と、スロットの比較1回で済む。
+ ****************************************/
+template<size_type K>
+struct PerfectHash {
+  // バケット数も2のべき乗にして、検索時に剰余(除算)ではなくマスクでバケットを選ぶ
+  static constexpr size_type bucket_num = std::bit_ceil( std::max<size_type>( K, 1 ) );
+  static constexpr size_type slot_num = 2 * bucket_num;
+  // 空きスロットを表す値
+  static constexpr size_type npos = K;
+
+  explicit consteval PerfectHash( std::array<std::string_view, K> const & keys ) : keys_( keys ), displacements_{}, slots_{} {
+    std::array<std::uint64_t, K> hashes{};
+    std::array<size_type, K> bucket_of{};
+    std::array<size_type, bucket_num + 1> bucket_offsets{};
+
+    for ( size_type i = 0; i < K; ++i ) {
+      hashes[i] = Hash( keys[i] );
+      bucket_of[i] = bucketOf( hashes[i] );
+      ++bucket_offsets[bucket_of[i] + 1];
+
+      for ( size_type j = 0; j < i; ++j ) {
+        if ( keys[i] == keys[j] ) { throw std::invalid_argument( "PerfectHash: keys are duplicated" ); }
+      }
+    }
+
+    // キーをバケットごとに並べ替える(計数ソート)
+    for ( size_type b = 0; b < bucket_num; ++b ) { bucket_offsets[b + 1] += bucket_offsets[b]; }
+
+    std::array<size_type, K> keys_in_bucket{};
+    std::array<size_type, bucket_num> filled{};
+    for ( size_type i = 0; i < K; ++i ) { keys_in_bucket[bucket_offsets[bucket_of[i]] + filled[bucket_of[i]]++] = i; }
+
+    std::array<size_type, bucket_num> bucket_order{};
+    for ( size_type b = 0; b < bucket_num; ++b ) { bucket_order[b] = b; }
+    std::sort( bucket_order.begin(), bucket_order.end(), [&bucket_offsets]( size_type const b1, size_type const b2 ) {
+      return ( bucket_offsets[b1 + 1] - bucket_offsets[b1] ) > ( bucket_offsets[b2 + 1] - bucket_offsets[b2] );
+    } );
+
+    std::fill( slots_.begin(), slots_.end(), npos );
+
+    for ( size_type const b : bucket_order ) {
+      size_type const first = bucket_offsets[b];
+      size_type const last = bucket_offsets[b + 1];
+
+      if ( first == last ) { break; }
+
+      displacements_[b] = findDisplacement( hashes, keys_in_bucket, first, last );
+
+      for ( size_type k = first; k < last; ++k ) { slots_[slotOf( hashes[keys_in_bucket[k]], displacements_[b] )] = keys_in_bucket[k]; }
+    }
+  }
+
+  // 見つからなければnposを返す
+  constexpr size_type find( std::string_view const str, std::uint64_t const hash ) const noexcept {
+    size_type const index = slots_[slotOf( hash, displacements_[bucketOf( hash )] )];
+    return ( index != npos && keys_[index] == str ) ? index : npos;
+  }
+
+  constexpr std::string_view key( size_type const index ) const noexcept { return keys_[index]; }
+
+private:
+  static constexpr size_type bucketOf( std::uint64_t const hash ) noexcept { return Mix( hash, 0 ) & ( bucket_num - 1 ); }
+
+  static constexpr size_type slotOf( std::uint64_t const hash, std::uint32_t const displacement ) noexcept {
+    return Mix( hash, displacement ) & ( slot_num - 1 );
+  }
+
+  consteval std::uint32_t findDisplacement( std::array<std::uint64_t, K> const & hashes, std::array<size_type, K> const & keys_in_bucket, size_type const first, size_type const last ) const {
+    for ( std::uint32_t displacement = 1; displacement < ( 1U << 20 ); ++displacement ) {
+      bool fits = true;
+
+      for ( size_type k = first; k < last && fits; ++k ) {
+        size_type const slot = slotOf( hashes[keys_in_bucket[k]], displacement );
+        fits = ( slots_[slot] == npos );
+
+        // 同じバケット内のキー同士も衝突してはいけない
+        for ( size_type l = first; l < k && fits; ++l ) { fits = ( slot != slotOf( hashes[keys_in_bucket[l]], displacement ) ); }
+      }
+
+      if ( fits ) { return displacement; }
+    }
+
+    throw std::length_error( "PerfectHash: displacement is not found" );
+  }
+
+  std::array<std::string_view, K> keys_;
+  std::array<std::uint32_t, bucket_num> displacements_;
+  std::array<size_type, slot_num> slots_;
+};
+
+} // STRING
+
+} // violet
@@ -25,10 +25,29 @@ using size_type = std::size_t;
 
 namespace STRING {
 
+// 1文字ずつループすると、長いリテラルで定数評価のステップ数の上限に達してしまう。
+// __builtin_strlenはclangでもgccでも1回の組み込み関数呼び出しとして定数評価される。
 consteval index_type Length( char const * const string ) {
-  index_type index = 0;
-  while ( string[index] != '\0' ) { ++index; }
-  return index;
+  return __builtin_strlen( string );
+}
+
+// countだけコピーする。
+// clangは__builtin_memcpyを1回の組み込み関数呼び出しとして定数評価するので、長さによらず上限に達しない。
+// gccは定数評価中にmemcpyを使えないが、上限(-fconstexpr-loop-limit)は1つのループの反復回数に対してかかるので、
+// ブロックに分けて二重ループでコピーする。
+template<typename CharT>
+constexpr void CopyN( CharT const * const source, size_type const count, CharT * const destination ) {
+#if defined( __clang__ )
+  __builtin_memcpy( destination, source, count * sizeof( CharT ) );
+#else
+  constexpr size_type block_size = 4096;
+
+  for ( size_type offset = 0; offset < count; offset += block_size ) {
+    size_type const end = std::min( offset + block_size, count );
+
+    for ( size_type index = offset; index < end; ++index ) { destination[index] = source[index]; }
+  }
+#endif
 }
 
 template<class T>
@@ -38,9 +57,7 @@ concept HasFunctionCall = requires() {
 
 template<HasFunctionCall StringProxy>
 consteval index_type Length() {
-  index_type index = 0;
-  while ( StringProxy()()[index] != '\0' ) { ++index; }
-  return index;
+  return Length( StringProxy()() );
 }
 
 // N文字だけ比較して、同一文字列だったらtrue、
@@ -74,12 +91,15 @@ struct ExcludeNULLLiteralImpl : public ::util::COMPARABLE::CompDef<ExcludeNULLLi
 
   explicit consteval ExcludeNULLLiteralImpl() : str_{ '\0' }, len_( 0 ) {}
 
-  explicit consteval ExcludeNULLLiteralImpl( CharT const ( & literal )[N + 1] ) : len_( N ) { std::copy_n( literal, N, str_ ); }
+  explicit consteval ExcludeNULLLiteralImpl( CharT const ( & literal )[N + 1] ) : len_( N ) { CopyN( literal, N, str_ ); }
 
-  template<size_type... INDICES>
-  explicit consteval ExcludeNULLLiteralImpl( CharT const * literal_p, std::index_sequence<INDICES...> )
-  : str_{ ( INDICES <= N ? literal_p[INDICES] : value_type() ) ... }
-    , len_( !( N < Length( literal_p ) ) ? Length( literal_p ) : throw std::length_error( "ExcludeNULLLiteralImpl: literal of argument is too long" ) ) {}
+  // 長さは呼び出し側で一度だけ計算して渡す。
+  // index_sequenceをN要素に展開せず、残りは値初期化で'\0'にしておくので、
+  // 長いリテラルでもコンパイル時間が線形に収まる。
+  explicit consteval ExcludeNULLLiteralImpl( CharT const * literal_p, size_type const len )
+  : str_{}, len_( !( N < len ) ? len : throw std::length_error( "ExcludeNULLLiteralImpl: literal of argument is too long" ) ) {
+    CopyN( literal_p, len, str_ );
+  }
 
   template<size_type... INDICES, typename... Args>
   explicit consteval ExcludeNULLLiteralImpl( std::index_sequence<INDICES...>, Args&& ... args )
@@ -140,7 +160,7 @@ protected:
 
 // 末尾の'\0'を含めないようにするための補助推論(補助推論はC++17から)
 template<typename CharT, size_type N>
-ExcludeNULLLiteralImpl( CharT const ( & literal )[N], std::make_index_sequence<N>() ) -> ExcludeNULLLiteralImpl<CharT, N - 1>;
+ExcludeNULLLiteralImpl( CharT const ( & literal )[N], size_type ) -> ExcludeNULLLiteralImpl<CharT, N - 1>;
 
 ////////////////////
 // operator<
@@ -187,14 +207,15 @@ struct Literal : public ExcludeNULLLiteralImpl<CharT, N> {
   using impl_type = ExcludeNULLLiteralImpl<CharT, N>;
 
   explicit consteval Literal() : ExcludeNULLLiteralImpl<CharT, N>() {}
-  explicit consteval Literal( CharT const ( & string_literal )[N + 1] ) : ExcludeNULLLiteralImpl<CharT, N>( string_literal, std::make_index_sequence<N>() ) {}
+  // 配列の途中に'\0'があれば、そこまでを文字列の長さとする
+  explicit consteval Literal( CharT const ( & string_literal )[N + 1] ) : ExcludeNULLLiteralImpl<CharT, N>( string_literal, Length( string_literal ) ) {}
   template<typename... Args>
   explicit consteval Literal( Args&& ... args ) : ExcludeNULLLiteralImpl<CharT, N>( std::make_index_sequence<sizeof...(Args)>(), args... ) {}
 
-  Literal<CharT, N> ( Literal<CharT, N>  const & ) = default;
-  Literal<CharT, N> & operator=( Literal<CharT, N> const & ) = default;
-  Literal<CharT, N> ( Literal<CharT, N> && rhs ) = default;
-  Literal<CharT, N> & operator=( Literal<CharT, N> && ) = default;
+  Literal( Literal const & ) = default;
+  Literal & operator=( Literal const & ) = default;
+  Literal( Literal && ) = default;
+  Literal & operator=( Literal && ) = default;
 
   constexpr typename impl_type::iterator begin() noexcept { return impl_type::makeIterator( 0 ); }
   constexpr typename impl_type::iterator end() noexcept { return impl_type::makeIterator( impl_type::len_ ); }
@@ -206,7 +227,7 @@ struct Literal : public ExcludeNULLLiteralImpl<CharT, N> {
 template<typename CharT, size_type N, util::if_nullp_c<( N > 0 )>* NPTR>
 struct Literal<CharT const *, N, NPTR> : public ExcludeNULLLiteralImpl<CharT, N> {
   using impl_type = ExcludeNULLLiteralImpl<CharT, N>;
-  explicit consteval Literal( CharT const * string_literal_p ) : ExcludeNULLLiteralImpl<CharT, N>( string_literal_p, std::make_index_sequence<N>() ) {}
+  explicit consteval Literal( CharT const * string_literal_p ) : ExcludeNULLLiteralImpl<CharT, N>( string_literal_p, Length( string_literal_p ) ) {}
 };
 
 ////////////////////
@@ -220,14 +241,22 @@ inline STATIC_CONSTEXPR std::basic_ostream<CharT>& operator << ( std::basic_ostr
 ////////////////////
 // operator+
 ////////////////////
-template<typename CharT, size_type N1, size_type N2, size_type... INDICES>
-inline consteval auto ConcateImpl( ExcludeNULLLiteralImpl<CharT, N1> const & literal1, size_type len1, ExcludeNULLLiteralImpl<CharT, N2> const & literal2, size_type len2, std::index_sequence<INDICES...> ) {
-  return Literal<CharT, N1 + N2>( ( INDICES < len1 ? literal1[INDICES] : INDICES < ( len1 + len2 ) ? literal2[INDICES - len1] : CharT() ) ... );
+// 文字を可変長引数として渡すと、N1 + N2個の引数をもつ関数呼び出しになってしまうので、
+// 結果のLiteralへ直接コピーする。
+template<typename CharT, size_type N1, size_type N2>
+inline consteval auto ConcateImpl( ExcludeNULLLiteralImpl<CharT, N1> const & literal1, size_type len1, ExcludeNULLLiteralImpl<CharT, N2> const & literal2, size_type len2 ) {
+  Literal<CharT, N1 + N2> result;
+
+  CopyN( literal1.get(), len1, result.str_ );
+  CopyN( literal2.get(), len2, result.str_ + len1 );
+  result.len_ = len1 + len2;
+
+  return result;
 }
 
 template<typename CharT, size_type N1, size_type N2>
 inline consteval auto Concate( Literal<CharT, N1> const & literal1, Literal<CharT, N2> const & literal2 ) {
-  return ConcateImpl( literal1, literal1.length(), literal2, literal2.length(), std::make_index_sequence<N1 + N2>() );
+  return ConcateImpl( literal1, literal1.length(), literal2, literal2.length() );
 }
 
 template<typename CharT, size_type N1, size_type N2>
@@ -0,0 +1,88 @@
+/*****************************
+ * Copyright (c) 2023 Akito-Dataminer
+ * This software is distributed under the MIT license.
+ *****************************/
+
+#pragma once
+
+#include "violet/util/util.hpp"
+
+#include <atomic>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace violet {
+
+namespace util {
+
+/****************************************
+ * 複数スレッドから同時に確保できるバンプアロケータ
+ *
+ * 確保した領域は個別には解放せず、Arenaの破棄時にまとめて解放する。
+ * ブロック内の確保はfetch_addだけで済み、
+ * ブロックが足りなくなったときだけ新しいブロックをCASで差し替える。
+ ****************************************/
+class Arena {
+public:
+  explicit Arena( size_type const block_size ) : block_size_( block_size ), current_( new Block( nullptr, block_size, 0 ) ) {}
+
+  ~Arena() {
+    Block * block = current_.load( std::memory_order_acquire );
+
+    while ( block != nullptr ) {
+      Block * next = block->next_;
+      delete block;
+      block = next;
+    }
+  }
+
+  Arena( Arena const & ) = delete;
+  Arena & operator=( Arena const & ) = delete;
+
+  // alignは2のべき乗でなければならない
+  void * allocate( size_type const size, size_type const align ) {
+    size_type const padded_size = size + align - 1;
+
+    while ( true ) {
+      Block * block = current_.load( std::memory_order_acquire );
+      size_type const offset = block->used_.fetch_add( padded_size, std::memory_order_relaxed );
+
+      if ( offset + padded_size <= block->capacity_ ) { return alignUp( block->data_.get() + offset, align ); }
+
+      // 新しいブロックを作った側が先頭の領域を使う
+      Block * new_block = new Block( block, std::max( block_size_, padded_size ), padded_size );
+
+      if ( current_.compare_exchange_strong( block, new_block, std::memory_order_acq_rel, std::memory_order_acquire ) ) {
+        return alignUp( new_block->data_.get(), align );
+      }
+
+      // 他のスレッドが先にブロックを差し替えたので、そちらから確保し直す
+      delete new_block;
+    }
+  }
+
+private:
+  struct Block {
+    Block( Block * const next, size_type const capacity, size_type const used )
+    : next_( next ), capacity_( capacity ), used_( used ), data_( std::make_unique<std::byte[]>( capacity ) ) {}
+
+    Block * next_;
+    size_type capacity_;
+    std::atomic<size_type> used_;
+    std::unique_ptr<std::byte[]> data_;
+  };
+
+  static void * alignUp( std::byte * const ptr, size_type const align ) noexcept {
+    auto const address = reinterpret_cast<std::uintptr_t>( ptr );
+    return ptr + ( ( align - ( address & ( align - 1 ) ) ) & ( align - 1 ) );
+  }
+
+  size_type block_size_;
+  std::atomic<Block *> current_;
+};
+
+} // util
+
+} // violet